@@ -16,6 +16,8 @@ option(USE_COTIRE "Enable Cotire precompiled headers")
 
 option (ENABLE_LTO "Enable Link-Time Optimization" OFF)
 
+option (BUILD_TESTS "Build the component tests and benchmarks under */tests" OFF)
+
 # Some global on/off switches
 if (LIGHTWEIGHT_SYMTAB)
 add_definitions (-DWITHOUT_SYMTAB_API -DWITH_SYMLITE)
@@ -0,0 +1,32 @@
+# Helpers for the component tests and benchmarks under */tests, built
+# when BUILD_TESTS is on.  Drivers that pass or fail on their own are
+# registered with CTest and run from their binary directory, next to
+# their mutatees.
+
+include (CMakeParseArguments)
+
+# Threaded mutatees link ${CMAKE_THREAD_LIBS_INIT}
+find_package (Threads)
+
+# dyninst_test_program (name SOURCES ... LIBS ... [TEST] [TEST_ARGS ...])
+function (dyninst_test_program target)
+  cmake_parse_arguments (ARG "TEST" "" "SOURCES;LIBS;TEST_ARGS" ${ARGN})
+  add_executable (${target} ${ARG_SOURCES})
+  target_include_directories (${target} PRIVATE ${DYNINST_ROOT}/common/tests)
+  target_link_libraries (${target} ${ARG_LIBS})
+  if (ARG_TEST)
+    add_test (NAME ${target}
+              COMMAND ${target} ${ARG_TEST_ARGS}
+              WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR})
+  endif()
+endfunction()
+
+# dyninst_mutatee (name SOURCES ... [LIBS ...] [FLAGS ...])
+# Mutatees are plain C programs built without optimization, so their
+# functions and frames look the way the drivers expect.
+function (dyninst_mutatee target)
+  cmake_parse_arguments (ARG "" "" "SOURCES;LIBS;FLAGS" ${ARGN})
+  add_executable (${target} ${ARG_SOURCES})
+  target_compile_options (${target} PRIVATE -g -O0 ${ARG_FLAGS})
+  target_link_libraries (${target} ${ARG_LIBS})
+endfunction()
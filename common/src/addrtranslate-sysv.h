@@ -84,23 +84,51 @@ public:
 
 extern FileCache files;
 
+//Libraries are identified by the file they were loaded from and where
+// they were loaded.  The name is only used when the file can't be stat'd.
+struct LibKey
+{
+   dev_t device;
+   ino_t inode;
+   Address base;
+   std::string name;
+};
+
 struct LibCmp
 {
-   bool operator()(const std::pair<Address, std::string> &a,
-                   const std::pair<Address, std::string> &b) const
+   bool operator()(const LibKey &a, const LibKey &b) const
    {
-      if (a.first != b.first)
-         return a.first < b.first;
-      return a.second < b.second;
+      if (a.device != b.device)
+         return a.device < b.device;
+      if (a.inode != b.inode)
+         return a.inode < b.inode;
+      if (a.base != b.base)
+         return a.base < b.base;
+      return a.name < b.name;
    }
 };
 
+//A local copy of one element of the target's link_map chain
+struct link_entry_t
+{
+   Address map_addr;
+   Address l_addr;
+   Address l_name;
+   Address l_ld;
+   Address l_next;
+   Address l_prev;
+   std::string name;
+   dev_t device;
+   ino_t inode;
+};
+
 class AddressTranslateSysV : public AddressTranslate
 {
 public:
    bool init();
    virtual bool refresh();
    virtual Address getLibraryTrapAddrSysV();
+   virtual void setIncrementalRefresh(bool b);
 
    AddressTranslateSysV(int pid, ProcessReader *reader_, 
                         SymbolReaderFactory *reader_fact,
@@ -126,8 +154,27 @@ private:
    Address getTrapAddrFromRdebug();
 
    LoadedLib *getLoadedLibByNameAddr(Address addr, std::string name);
-   typedef std::map<std::pair<Address, std::string>, LoadedLib *, LibCmp> sorted_libs_t;
+   LoadedLib *getLoadedLibByNameAddr(Address addr, std::string name,
+                                     dev_t device, ino_t inode);
+   typedef std::map<LibKey, LoadedLib *, LibCmp> sorted_libs_t;
    sorted_libs_t sorted_libs;
+   sorted_libs_t found_libs;
+
+   /*
+    * The link_map chain as of the last refresh.  When link_chain_valid is
+    * set, the chain was read completely while incremental refresh was on,
+    * and a refresh that isn't preceded by an RT_DELETE only needs to read
+    * the elements appended after the old tail.
+    */
+   std::vector<link_entry_t> link_chain;
+   bool link_chain_valid;
+   bool pending_delete;
+
+   bool readLinkChain(Address head);
+   bool appendLinkChain(std::vector<link_entry_t> &chain, Address next,
+                        const std::map<Address, size_t> *old_index);
+   bool readLinkEntry(Address addr, link_entry_t &entry);
+   bool readLinkName(link_entry_t &entry);
 
    /* platform-specific functions */
    std::string getExecName();
@@ -111,6 +111,7 @@ class COMMON_EXPORT AddressTranslate {
    LoadedLib *exec;
    SymbolReaderFactory *symfactory;
    bool read_abort;
+   bool incremental_refresh;
  public:
 
     static AddressTranslate *createAddressTranslator(PID pid_,
@@ -138,6 +139,11 @@ class COMMON_EXPORT AddressTranslate {
     virtual Address getLibraryTrapAddrSysV();
    
     void setReadAbort(bool b);
+
+    //Set when every change to the library list is guaranteed to trigger
+    // a refresh (e.g, a breakpoint at the library trap address).  Lets
+    // the translator read only what changed since the last refresh.
+    virtual void setIncrementalRefresh(bool b);
 };
 
 }
@@ -192,7 +192,7 @@ class StatContainer {
     COMMON_EXPORT void stopTimer(const std::string&);
     COMMON_EXPORT void incrementCounter(const std::string&);
     COMMON_EXPORT void decrementCounter(const std::string&);
-    COMMON_EXPORT void addCounter(const std::string&, int);
+    COMMON_EXPORT void addCounter(const std::string&, long int);
 
  private:
     dyn_hash_map< std::string, Statistic * > stats_;
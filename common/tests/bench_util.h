@@ -0,0 +1,92 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Timing, memory and option helpers shared by the benchmarks under */tests
+
+#if !defined(BENCH_UTIL_H_)
+#define BENCH_UTIL_H_
+
+#include <time.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//Monotonic time in seconds
+static inline double bench_now_sec()
+{
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ts.tv_sec + ts.tv_nsec / 1000000000.0;
+}
+
+//Monotonic time in microseconds
+static inline double bench_now_usec()
+{
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ts.tv_sec * 1000000.0 + ts.tv_nsec / 1000.0;
+}
+
+//Resident set size of this process in KB, or 0 if it can't be read
+static inline long bench_rss_kb()
+{
+   FILE *f = fopen("/proc/self/status", "r");
+   if (!f)
+      return 0;
+   char line[256];
+   long kb = 0;
+   while (fgets(line, sizeof(line), f)) {
+      if (strncmp(line, "VmRSS:", 6) == 0) {
+         kb = atol(line + 6);
+         break;
+      }
+   }
+   fclose(f);
+   return kb;
+}
+
+//Prints the usage line for a benchmark and exits
+static inline void bench_usage(const char *prog, const char *args)
+{
+   fprintf(stderr, "Usage: %s %s\n", prog, args);
+   exit(-1);
+}
+
+//Parses the positive count given to an option, or exits with the usage line
+static inline unsigned bench_count_arg(const char *arg, const char *prog, const char *args)
+{
+   char *end = NULL;
+   unsigned long n = strtoul(arg, &end, 0);
+   if (!*arg || *end || !n || n > 0x7fffffffUL)
+      bench_usage(prog, args);
+   return (unsigned) n;
+}
+
+#endif
@@ -38,6 +38,7 @@
 #include "Operand.h"
 #include "Absloc.h"
 #include "util.h"
+#include "concurrent.h"
 
 class int_function;
 class BPatch_function;
@@ -49,6 +50,10 @@ namespace Dyninst {
     class Block;
   };
 
+// Both converters may cache their results per function. The caches are
+// concurrent, so a single converter can be shared by several threads;
+// clearCache(func) drops the entries of one function, e.g. after its
+// CFG was modified.
 class AbsRegionConverter {
  public:
  DATAFLOW_EXPORT AbsRegionConverter(bool cache, bool stack) :
@@ -90,6 +95,9 @@ class AbsRegionConverter {
 				  ParseAPI::Function *func,
                                   ParseAPI::Block *block,
 				  bool push);
+
+  DATAFLOW_EXPORT void clearCache(ParseAPI::Function *func);
+  DATAFLOW_EXPORT void clearCache();
   
  private:
   // Returns false if the current height is unknown.
@@ -112,7 +120,10 @@ class AbsRegionConverter {
   typedef std::vector<AbsRegion> RegionVec;
 
   typedef std::map<Address, RegionVec> AddrCache;
-  typedef std::map<ParseAPI::Function *, AddrCache> FuncCache;
+  typedef dyn_c_hash_map<ParseAPI::Function *, AddrCache> FuncCache;
+
+  bool lookupCache(FuncCache &, Address, ParseAPI::Function *, RegionVec &);
+  void updateCache(FuncCache &, Address, ParseAPI::Function *, const RegionVec &);
 
   FuncCache used_cache_;
   FuncCache defined_cache_;
@@ -122,7 +133,7 @@ class AbsRegionConverter {
 
 class AssignmentConverter {
  public:  
- DATAFLOW_EXPORT AssignmentConverter(bool cache, bool stack) : cacheEnabled_(cache), aConverter(false, stack) {};
+ DATAFLOW_EXPORT AssignmentConverter(bool cache, bool stack) : cacheEnabled_(cache), cacheHits_(0), cacheMisses_(0), aConverter(false, stack) {};
 
   DATAFLOW_EXPORT void convert(const InstructionAPI::Instruction insn,
                                const Address &addr,
@@ -130,6 +141,12 @@ class AssignmentConverter {
                                ParseAPI::Block *block,
                                std::vector<Assignment::Ptr> &assignments);
 
+  DATAFLOW_EXPORT void clearCache(ParseAPI::Function *func);
+  DATAFLOW_EXPORT void clearCache();
+
+  // Lookups answered from / missed by the cache since construction
+  DATAFLOW_EXPORT unsigned long cacheHits() const { return cacheHits_.load(); }
+  DATAFLOW_EXPORT unsigned long cacheMisses() const { return cacheMisses_.load(); }
 
  private:
   void handlePushEquivalent(const InstructionAPI::Instruction I,
@@ -149,10 +166,12 @@ class AssignmentConverter {
 
   typedef std::vector<Assignment::Ptr> AssignmentVec;
   typedef std::map<Address, AssignmentVec> AddrCache;
-  typedef std::map<ParseAPI::Function *, AddrCache> FuncCache;
+  typedef dyn_c_hash_map<ParseAPI::Function *, AddrCache> FuncCache;
 
   FuncCache cache_;
   bool cacheEnabled_;
+  boost::atomic<unsigned long> cacheHits_;
+  boost::atomic<unsigned long> cacheMisses_;
 
   AbsRegionConverter aConverter;
 };
@@ -0,0 +1,88 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#if !defined(ANALYSIS_INVALIDATOR_H)
+#define ANALYSIS_INVALIDATOR_H
+
+#include <set>
+
+#include "ParseCallback.h"
+#include "util.h"
+
+class LivenessAnalyzer;
+
+namespace Dyninst {
+
+/** An AnalysisInvalidator keeps cached dataflow results consistent with a
+    CFG that is being modified (e.g. through CFGModifier or defensive-mode
+    reparsing).  Register it with the CodeObject; each notification marks
+    the blocks it touches, and the next query against an affected function
+    re-solves only the region of the CFG the edit can influence.
+
+    Stack analysis results live in Function annotations and are always
+    tracked.  LivenessAnalyzer instances must be added explicitly.
+**/
+
+class DATAFLOW_EXPORT AnalysisInvalidator : public ParseAPI::ParseCallback {
+ public:
+   AnalysisInvalidator() { }
+   virtual ~AnalysisInvalidator() { }
+
+   void track(LivenessAnalyzer *la) { liveness_.insert(la); }
+   void untrack(LivenessAnalyzer *la) { liveness_.erase(la); }
+
+ protected:
+   virtual void split_block_cb(ParseAPI::Block *orig, ParseAPI::Block *split);
+
+   virtual void destroy_cb(ParseAPI::Block *b);
+   virtual void destroy_cb(ParseAPI::Edge *) { }
+   virtual void destroy_cb(ParseAPI::Function *f);
+
+   virtual void remove_edge_cb(ParseAPI::Block *b, ParseAPI::Edge *e, edge_type_t t);
+   virtual void add_edge_cb(ParseAPI::Block *b, ParseAPI::Edge *e, edge_type_t t);
+
+   virtual void remove_block_cb(ParseAPI::Function *f, ParseAPI::Block *b);
+   virtual void add_block_cb(ParseAPI::Function *f, ParseAPI::Block *b);
+
+   virtual void modify_edge_cb(ParseAPI::Edge *e, ParseAPI::Block *b, edge_type_t t);
+
+ private:
+   void touch(ParseAPI::Block *b, bool edgesRemoved);
+   void touch(ParseAPI::Function *f, ParseAPI::Block *b, bool edgesRemoved);
+
+   std::set<LivenessAnalyzer *> liveness_;
+   // Functions we have recorded edits against; a destroyed block may
+   // already be detached from its functions by the time we hear about it
+   std::set<ParseAPI::Function *> edited_;
+};
+
+}
+
+#endif
@@ -51,13 +51,17 @@ class InstructionCache
 {
   std::map<Address, ReadWriteInfo> cache;
   ParseAPI::Function* currentFunction;
+  unsigned long hits;
+  unsigned long misses;
 
   public:
-  InstructionCache(): currentFunction(NULL) {}
+  InstructionCache(): currentFunction(NULL), hits(0), misses(0) {}
   bool getLivenessInfo(Address addr, ParseAPI::Function* func, ReadWriteInfo& rw);
   void insertInstructionInfo(Address addr, ReadWriteInfo rw, ParseAPI::Function* func);
   void clean() {cache.clear();}
   ParseAPI::Function* getCurFunc() {return currentFunction;}
+  unsigned long getHits() const {return hits;}
+  unsigned long getMisses() const {return misses;}
 };
 
 #endif //!defined(INSTRUCTION_CACHE_H)
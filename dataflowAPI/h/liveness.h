@@ -57,6 +57,12 @@ class DATAFLOW_EXPORT LivenessAnalyzer{
         std::map<ParseAPI::Function*, bitArray> funcRegsDefined;
 	InstructionCache cachedLivenessInfo;
 
+	// Blocks touched by CFG edits since their function was analyzed, and
+	// the functions that lost an edge in the process
+	std::map<ParseAPI::Function*, std::set<ParseAPI::Block*> > dirtyBlocks;
+	std::set<ParseAPI::Function*> dirtyEdgesRemoved;
+	void reanalyze(ParseAPI::Function *func);
+
 	const bitArray& getLivenessIn(ParseAPI::Block *block);
 	const bitArray& getLivenessOut(ParseAPI::Block *block, bitArray &allRegsDefined);
 	void processEdgeLiveness(ParseAPI::Edge* e, livenessData& data, ParseAPI::Block* block, const bitArray& allRegsDefined);
@@ -100,9 +106,22 @@ public:
 	void clean(ParseAPI::Function *func);
 	void clean();
 
+	// CFG modification notifications (see AnalysisInvalidator).  Rather
+	// than discarding the whole function, the next query re-summarizes the
+	// touched blocks and re-runs the fixpoint from them.
+	void invalidate(ParseAPI::Function *func, ParseAPI::Block *block, bool edgesRemoved = false);
+	void invalidate(ParseAPI::Block *block, bool edgesRemoved = false);
+	void splitBlock(ParseAPI::Block *orig, ParseAPI::Block *split);
+	void removeBlock(ParseAPI::Block *block);
+	void removeFunction(ParseAPI::Function *func);
+
 	int getIndex(MachRegister machReg);
 	ABI* getABI() { return abi;}
 
+	// Hits and misses of the per-instruction read/write set cache
+	unsigned long getCacheHits() const { return cachedLivenessInfo.getHits(); }
+	unsigned long getCacheMisses() const { return cachedLivenessInfo.getMisses(); }
+
 private:
 	ErrorType errorno;
 };
@@ -0,0 +1,173 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Reaching definitions and def-use chains over AbsRegions.
+//
+// A single forward bit-vector pass over a function computes, for every
+// instruction, which assignments (as produced by AssignmentConverter) may
+// reach each region it reads. This answers the same question as a series of
+// one-step backward slices for a fraction of the cost. The chains are
+// stored in compressed sparse row form in both directions (use -> defs,
+// def -> uses) and queried by instruction address.
+//
+// Definitions of concrete abslocs (registers, resolved stack slots) kill
+// earlier definitions of the same absloc; definitions of typed regions
+// (e.g. unknown heap or stack locations) never kill. A use is reached by
+// every live definition whose region may overlap it. A use that no
+// definition reaches is live-in to the function.
+
+#if !defined(REACHING_DEFS_H)
+#define REACHING_DEFS_H
+
+#include <map>
+#include <vector>
+
+#include "Absloc.h"
+#include "AbslocInterface.h"
+#include "bitArray.h"
+#include "dyntypes.h"
+
+namespace Dyninst {
+
+namespace ParseAPI {
+   class Function;
+   class Block;
+};
+
+class ReachingDefinitions {
+ public:
+   struct Use {
+      Address addr;
+      AbsRegion region;
+   };
+
+   DATAFLOW_EXPORT ReachingDefinitions(ParseAPI::Function *func,
+                                       bool stackAnalysis = true);
+
+   // Use a converter owned by the caller, e.g. one already warmed up and
+   // shared with Slicer instances over the same function.
+   DATAFLOW_EXPORT ReachingDefinitions(ParseAPI::Function *func,
+                                       AssignmentConverter *ac);
+
+   // Queries run the analysis on first use; calling this up front is
+   // only needed to control when the cost is paid.
+   DATAFLOW_EXPORT bool analyze();
+
+   // Assignments made by the instruction at addr
+   DATAFLOW_EXPORT bool definitionsAt(Address addr,
+                                      std::vector<Assignment::Ptr> &defs);
+
+   // Regions read by the instruction at addr
+   DATAFLOW_EXPORT bool usesAt(Address addr, std::vector<Use> &uses);
+
+   // Definitions reaching the instruction at addr, for all the regions it
+   // reads or only for those overlapping region
+   DATAFLOW_EXPORT bool reachingDefinitions(Address addr,
+                                            std::vector<Assignment::Ptr> &defs);
+   DATAFLOW_EXPORT bool reachingDefinitions(Address addr,
+                                            const AbsRegion &region,
+                                            std::vector<Assignment::Ptr> &defs);
+
+   // Uses reached by def, which must have come from definitionsAt
+   DATAFLOW_EXPORT bool uses(const Assignment::Ptr &def,
+                             std::vector<Use> &uses);
+
+   DATAFLOW_EXPORT size_t numDefinitions() const { return defs_.size(); }
+   DATAFLOW_EXPORT size_t numUses() const { return useAddrs_.size(); }
+   DATAFLOW_EXPORT size_t numChains() const { return useDefs_.size(); }
+
+ private:
+   typedef unsigned DefID;
+   typedef unsigned UseID;
+   typedef unsigned RegionID;
+
+   // One decoded instruction: its uses and definitions are contiguous
+   // ranges of useAddrs_ and defs_
+   struct InsnRecord {
+      Address addr;
+      UseID firstUse, lastUse;
+      DefID firstDef, lastDef;
+   };
+
+   RegionID internRegion(const AbsRegion &region);
+   void collectBlock(ParseAPI::Block *block);
+   void buildAliases();
+   void buildBlockSummaries();
+   void fixpoint();
+   void buildChains();
+
+   // [first, last) indices of defs_/useAddrs_ made at addr
+   std::pair<DefID, DefID> defRange(Address addr) const;
+   std::pair<UseID, UseID> useRange(Address addr) const;
+
+   ParseAPI::Function *func_;
+   AssignmentConverter converter;
+   AssignmentConverter *shared_converter;
+   bool analyzed_;
+   bool valid_;
+
+   // Interned regions, the definitions of each, which regions each may
+   // overlap (itself included), and the definitions a write to each kills
+   // (empty for regions that never kill)
+   std::vector<AbsRegion> regions_;
+   std::map<AbsRegion, RegionID> regionIDs_;
+   std::vector<std::vector<DefID> > regionDefs_;
+   std::vector<std::vector<RegionID> > regionAliases_;
+   std::vector<bitArray> killMasks_;
+
+   // Definitions and uses, both in instruction address order
+   std::vector<Assignment::Ptr> defs_;
+   std::vector<RegionID> defRegions_;
+   std::vector<Address> defAddrs_;
+   std::vector<Address> useAddrs_;
+   std::vector<RegionID> useRegions_;
+
+   // Per-block instructions and fixpoint state, indexed like blocks_. The
+   // bit vectors are released once the chains are built.
+   std::vector<ParseAPI::Block *> blocks_;
+   std::map<ParseAPI::Block *, unsigned> blockIndex_;
+   std::vector<std::vector<InsnRecord> > blockInsns_;
+   std::vector<bitArray> gen_;
+   std::vector<bitArray> kill_;
+   std::vector<bitArray> in_;
+   std::vector<bitArray> out_;
+
+   // Chains in CSR form: the definitions reaching use u are
+   // useDefs_[useDefStart_[u] .. useDefStart_[u+1]), and the uses reached
+   // by definition d are defUses_[defUseStart_[d] .. defUseStart_[d+1])
+   std::vector<unsigned> useDefStart_;
+   std::vector<DefID> useDefs_;
+   std::vector<unsigned> defUseStart_;
+   std::vector<UseID> defUses_;
+};
+
+}
+
+#endif
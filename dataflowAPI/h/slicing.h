@@ -142,6 +142,13 @@ class Slicer {
 	 ParseAPI::Function *func,
 	 bool cache = true,
 	 bool stackAnalysis = true);
+
+  // Use a converter owned by the caller instead of a private one; a
+  // caching converter can be shared by slicers on different threads
+  DATAFLOW_EXPORT Slicer(AssignmentPtr a,
+	 ParseAPI::Block *block,
+	 ParseAPI::Function *func,
+	 AssignmentConverter *ac);
     
   DATAFLOW_EXPORT static bool isWidenNode(Node::Ptr n);
 
@@ -721,6 +728,7 @@ private:
   std::set<Address> addrSet;
 
   AssignmentConverter converter;
+  AssignmentConverter *shared_converter;
 
   SliceNode::Ptr widen_;
  public: 
@@ -492,6 +492,30 @@ public:
    typedef std::map<ParseAPI::Block *, std::map<Offset, TransferSet> >
       CallEffects;
 
+   // Where each block's block-level definitions were actually made; used to
+   // resolve the address-less definitions produced by SummaryFunc::apply.
+   typedef std::map<ParseAPI::Block *, std::map<Absloc, Address> >
+      DefinitionAddrs;
+
+   // The fixpoint solution is kept alongside the intervals so that a CFG
+   // edit can be re-solved from the blocks it touched rather than from the
+   // function entry.
+   struct FixpointState {
+      BlockState inputs;
+      BlockState outputs;
+      DefinitionAddrs defAddrs;
+   };
+
+   // Blocks touched by CFG edits since the intervals were last computed.
+   // If any edge was removed, heights downstream of the touched blocks may
+   // rise, so those blocks are re-solved from TOP instead of from their
+   // previous state.
+   struct PendingEdits {
+      std::set<ParseAPI::Block *> blocks;
+      bool edgesRemoved;
+      PendingEdits() : edgesRemoved(false) {}
+   };
+
    DATAFLOW_EXPORT StackAnalysis();
    DATAFLOW_EXPORT StackAnalysis(ParseAPI::Function *f);
    DATAFLOW_EXPORT StackAnalysis(ParseAPI::Function *f,
@@ -517,6 +541,17 @@ public:
 
    DATAFLOW_EXPORT void debug();
 
+   // CFG modification notifications (see AnalysisInvalidator).  These only
+   // record the change against the function's cached results; the next
+   // query re-solves the affected region.
+   DATAFLOW_EXPORT static void invalidateBlock(ParseAPI::Function *f,
+      ParseAPI::Block *b, bool edgesRemoved = false);
+   DATAFLOW_EXPORT static void splitBlock(ParseAPI::Function *f,
+      ParseAPI::Block *orig, ParseAPI::Block *split);
+   DATAFLOW_EXPORT static void removeBlock(ParseAPI::Function *f,
+      ParseAPI::Block *b);
+   DATAFLOW_EXPORT static void invalidateFunction(ParseAPI::Function *f);
+
 private:
    std::string format(const AbslocState &input) const;
    std::string format(const TransferSet &input) const;
@@ -527,9 +562,16 @@ private:
    bool analyze();
    bool genInsnEffects();
    void summarizeBlocks(bool verbose = false);
+   void summarizeBlock(ParseAPI::Block *block, bool verbose = false);
    void summarize();
+   void summarizeIntervals(ParseAPI::Block *block, AbslocState input);
+   void resolveDefinitions(StateIntervals &sintervals);
 
    void fixpoint(bool verbose = false);
+   void incrementalFixpoint(std::set<ParseAPI::Block *> &region,
+      std::set<ParseAPI::Block *> &changed);
+   bool reanalyzePendingEdits();
+   bool loadIntervals();
    void summaryFixpoint();
 
    void createIntervals();
@@ -623,6 +665,7 @@ private:
 
    BlockState blockInputs;
    BlockState blockOutputs;
+   DefinitionAddrs defAddrs;
 
    // Like blockInputs and blockOutputs, but used for function summaries.
    // Instead of tracking Heights, we track transfer functions.
@@ -57,6 +57,63 @@ typedef enum {
     FE_No_Error
 } FrameErrors_t;
 
+/**
+ * A compact, precompiled form of an object's CFI for fast unwinding.
+ * Each row covers [lo, lo+len) and describes the CFA as SP or FP plus an
+ * offset, and the return address and frame pointer as undefined, same
+ * value, or saved at CFA plus an offset.  Rows whose rules need a full
+ * DWARF expression are marked complex; callers fall back to
+ * DwarfFrameParser::getRegValueAtFrame for those.
+ **/
+class DYNDWARF_EXPORT UnwindTable {
+public:
+    typedef boost::shared_ptr<UnwindTable> Ptr;
+
+    enum {
+        base_sp = 0,
+        base_fp,
+        base_complex
+    };
+
+    enum {
+        rule_undefined = 0,
+        rule_same,
+        rule_offset,
+        rule_complex
+    };
+
+    struct row_t {
+        Address lo;
+        uint32_t len;
+        int32_t cfa_off;
+        int32_t ra_off;
+        int32_t fp_off;
+        uint8_t cfa_base;
+        uint8_t ra_rule;
+        uint8_t fp_rule;
+        uint8_t pad;
+    };
+
+    UnwindTable();
+
+    //Returns the row covering pc, or NULL.
+    const row_t *find(Address pc) const;
+    size_t size() const;
+
+    //Rows may be added in any order; finish() sorts them and merges
+    // adjacent rows with identical rules.
+    void addRow(const row_t &row);
+    void finish();
+
+    //Persist the table.  'ident' should identify the object version
+    // (e.g, its size and mtime); load fails if it does not match.
+    bool save(std::string path, unsigned long ident) const;
+    static Ptr load(std::string path, unsigned long ident);
+
+private:
+    std::vector<row_t> rows;
+};
+
 class DYNDWARF_EXPORT DwarfFrameParser {
 public:
 
@@ -96,10 +153,16 @@ public:
             std::vector<VariableLocation> &locs,
             FrameErrors_t &err_result);
 
+    // Returns this object's CFI precompiled into an UnwindTable.  The
+    // table is built on first use and shared by every caller.
+    UnwindTable::Ptr getUnwindTable();
 
 private:
 
     void setupCFIData();
+    void buildUnwindTable();
+    void addUnwindRows(Dwarf_CFI *cfi, Elf *elf, const char *sec_name,
+                       bool eh_frame_p, UnwindTable &table);
 
     struct frameParser_key
     {
@@ -155,6 +218,11 @@ private:
 
     dyn_mutex cfi_lock;
     std::vector<Dwarf_CFI *> cfi_data;
+    Dwarf_CFI *debug_frame_cfi;
+    Dwarf_CFI *eh_frame_cfi;
+
+    boost::once_flag unwind_once;
+    UnwindTable::Ptr unwind_table;
 
 };
 
@@ -200,7 +200,7 @@ class PARSER_EXPORT CodeSource : public Dyninst::InstructionSource {
 
     // manage statistics
     virtual void incrementCounter(const std::string& /*name*/) const { return; } 
-    virtual void addCounter(const std::string& /*name*/, int /*num*/) const { return; }
+    virtual void addCounter(const std::string& /*name*/, long int /*num*/) const { return; }
     virtual void decrementCounter(const std::string& /*name*/) const { return; }
     virtual void startTimer(const std::string& /*name*/) const { return; } 
     virtual void stopTimer(const std::string& /*name*/) const { return; }
@@ -321,7 +321,7 @@ class PARSER_EXPORT SymtabCodeSource : public CodeSource, public boost::lockable
 
     // manage statistics
     void incrementCounter(const std::string& name) const;
-    void addCounter(const std::string& name, int num) const; 
+    void addCounter(const std::string& name, long int num) const; 
     void decrementCounter(const std::string& name) const;
     void startTimer(const std::string& /*name*/) const; 
     void stopTimer(const std::string& /*name*/) const;
@@ -112,6 +112,8 @@ const;
     virtual bool isReturnAddrSave(Address &ret_addr) const = 0; // ret_addr holds the return address pushed in the stack using mflr at function entry 
     virtual bool isTailCall(const ParseAPI::Function *, ParseAPI::EdgeTypeEnum type, unsigned int num_insns,
                             const std::set<Address> &) const = 0;
+    // True if the last jump table analysis gave up because it ran out of budget
+    bool exceededJumpTableBudget() const { return jumpTableBudgetExceeded; }
     protected:
     	// Uses pattern heuristics or backward slicing to determine if a blr instruction is a return or jump table
         virtual bool isReturn(Dyninst::ParseAPI::Function * context, Dyninst::ParseAPI::Block* currBlk) const = 0;
@@ -120,6 +122,7 @@ const;
     Address previous;
     mutable bool parsedJumpTable;
     mutable bool successfullyParsedJumpTable;
+    mutable bool jumpTableBudgetExceeded;
     mutable bool isDynamicCall_;
     mutable bool checkedDynamicCall_;
     mutable bool isInvalidCallTarget_;
@@ -123,7 +123,7 @@ class SymReaderCodeSource : public CodeSource {
 
     // manage statistics
     void incrementCounter(const std::string& name) const;
-    void addCounter(const std::string& name, int num) const; 
+    void addCounter(const std::string& name, long int num) const; 
     void decrementCounter(const std::string& name) const;
 
  private:
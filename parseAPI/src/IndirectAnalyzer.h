@@ -6,14 +6,52 @@
 #include "CFG.h"
 #include "slicing.h"
 #include "BoundFactCalculator.h"
+
+#include <boost/timer/timer.hpp>
 using namespace Dyninst;
 
+/* Limits the amount of work a single jump table analysis may perform.
+ * The slicing predicates charge one step for every slice node they
+ * visit; the bound calculation run on a finished slice is not charged
+ * and is not interrupted. A limit of zero means unlimited.
+ *
+ * Limits are read once from the environment:
+ *   DYNINST_JUMPTABLE_TIME_LIMIT  wall clock milliseconds per jump table
+ *   DYNINST_JUMPTABLE_STEP_LIMIT  slice steps per jump table
+ *   DYNINST_DEFER_JUMPTABLES      if set, jump tables that run out of budget
+ *                                 are retried after the main parse with a
+ *                                 budget scaled by this factor (0 = unlimited)
+ */
+class JumpTableBudget {
+    boost::timer::cpu_timer timer;
+    unsigned long timeLimit;
+    unsigned long stepLimit;
+    unsigned long steps;
+    bool exceeded;
+
+public:
+    JumpTableBudget(unsigned long t, unsigned long s);
+
+    // Charge one step; returns false once the budget is used up
+    bool charge();
+    bool isExceeded() const { return exceeded; }
+    unsigned long usedSteps() const { return steps; }
+    unsigned long elapsedUsecs() const;
+
+    // Budget for analyses run inline with frame parsing
+    static JumpTableBudget inlineBudget();
+    // Budget for analyses deferred to the separate jump table phase
+    static JumpTableBudget deferredBudget();
+    static bool deferralEnabled();
+};
+
 class IndirectControlFlowAnalyzer {
     // The function and block that contain the indirect jump
     ParseAPI::Function *func;
     ParseAPI::Block *block;
     set<ParseAPI::Block*> reachable;
     ThunkData thunks;
+    JumpTableBudget *budget;
 
     void GetAllReachableBlock();  
     void FindAllThunks();
@@ -32,11 +70,14 @@ class IndirectControlFlowAnalyzer {
     int GetMemoryReadSize(Assignment::Ptr loc);
     bool IsZeroExtend(Assignment::Ptr loc);
     bool FindJunkInstruction(Address);
+    bool OutOfBudget(const char *phase);
 
 
 public:
     bool NewJumpTableAnalysis(std::vector<std::pair< Address, Dyninst::ParseAPI::EdgeTypeEnum > >& outEdges);
-    IndirectControlFlowAnalyzer(ParseAPI::Function *f, ParseAPI::Block *b): func(f), block(b) {}
+    // True if the last analysis gave up because it ran out of budget
+    bool budgetExceeded() const { return budget && budget->isExceeded(); }
+    IndirectControlFlowAnalyzer(ParseAPI::Function *f, ParseAPI::Block *b, JumpTableBudget *jtb = NULL): func(f), block(b), budget(jtb) {}
 
 };
 
@@ -10,6 +10,8 @@
 //#include "BoundFactCalculator.h"
 using namespace Dyninst;
 
+class JumpTableBudget;
+
 class JumpTableFormatPred : public Slicer::Predicates {
 public:
     ParseAPI::Function *func;
@@ -34,6 +36,10 @@ public:
     // On ppc 64, r2 is reserved for storing the address of the global offset table 
     Address toc_address;
 
+    // Optional limit on the slicing work; slicing stops once it is used up
+    JumpTableBudget *budget;
+    void setBudget(JumpTableBudget *b) { budget = b; }
+
     virtual bool modifyCurrentFrame(Slicer::SliceFrame &frame, Graph::Ptr g, Slicer*);
     std::string format();
     bool isJumpTableFormat() { return jumpTableFormat && findIndex && findTableBase && memLoc;}
@@ -10,6 +10,8 @@
 #include "Absloc.h"
 using namespace Dyninst;
 
+class JumpTableBudget;
+
 class JumpTableIndexPred : public Slicer::Predicates {
 
     ParseAPI::Function *func;
@@ -17,6 +19,7 @@ class JumpTableIndexPred : public Slicer::Predicates {
     AbsRegion index;
     SymbolicExpression &se;
     std::vector<AST::Ptr> readAST;
+    JumpTableBudget *budget;
     
     bool MatchReadAST(Assignment::Ptr a);
 
@@ -28,6 +31,8 @@ public:
     std::set<Assignment::Ptr> currentAssigns;
     virtual bool addNodeCallback(AssignmentPtr ap, std::set<ParseAPI::Edge*> &visitedEdges);
     virtual bool modifyCurrentFrame(Slicer::SliceFrame &frame, Graph::Ptr g, Slicer*);
+    // Optional limit on the slicing work; slicing stops once it is used up
+    void setBudget(JumpTableBudget *b) { budget = b; }
     GraphPtr BuildAnalysisGraph(std::set<ParseAPI::Edge*> &visitedEdges);
     bool IsIndexBounded(GraphPtr slice, BoundFactsCalculator &bfc, StridedInterval &target);
     bool FillInOutEdges(StridedInterval &target, std::vector<std::pair< Address, Dyninst::ParseAPI::EdgeTypeEnum > >& outEdges);
@@ -40,7 +45,8 @@ public:
 		          : func(f), 
 			    block(b),
 			    index(i),
-			    se(sym) {
+			    se(sym),
+			    budget(NULL) {
 			       unknownInstruction = false;
 			       findBound = false;
 		      }
@@ -89,6 +89,11 @@ namespace Dyninst {
             boost::atomic<bool> delayed_frames_changed;
             dyn_c_hash_map<Function*, std::set<ParseFrame*> > delayed_frames;
 
+            // Jump tables whose analysis ran out of budget while parsing
+            // their frame; they are retried in a separate parallel phase
+            dyn_c_hash_map<Function*, std::set<Address> > deferred_jump_tables;
+            std::set<std::pair<Function*, Address> > attempted_deferred_jump_tables;
+
             // differentiate those provided via hints and
             // those found through RT or speculative parsing
             dyn_c_vector<Function *> hint_funcs;
@@ -217,9 +222,12 @@ namespace Dyninst {
                     ParseFrame &frame, Address target, Block *cur, Edge *exist);
 
     void parse_frames(LockFreeQueue<ParseFrame *> &, bool);
+    void parse_frames_to_fixpoint(LockFreeQueue<ParseFrame *> &, bool);
     void parse_frame(ParseFrame & frame,bool);
     bool parse_frame_one_iteration(ParseFrame & frame, bool);
     bool inspect_value_driven_jump_tables(ParseFrame &);
+    void defer_jump_table(Function *, Address);
+    bool resolve_deferred_jump_tables(LockFreeQueue<ParseFrame *> &);
 
     void resumeFrames(Function * func, LockFreeQueue<ParseFrame *> & work);
 
@@ -73,10 +73,19 @@ extern const std::string PARSE_NORETURN_HEURISTIC;
 
 extern const std::string PARSE_JUMPTABLE_COUNT;
 extern const std::string PARSE_JUMPTABLE_FAIL;
+extern const std::string PARSE_JUMPTABLE_BUDGET_EXCEEDED;
+extern const std::string PARSE_JUMPTABLE_DEFERRED;
+extern const std::string PARSE_JUMPTABLE_DEFERRED_RESOLVED;
 extern const std::string PARSE_TAILCALL_COUNT;
 extern const std::string PARSE_TAILCALL_FAIL;
 
 extern const std::string PARSE_TOTAL_TIME;
 extern const std::string PARSE_JUMPTABLE_TIME;
+// Time spent in each phase of jump table analysis, accumulated as counters
+// (in microseconds) because the analysis runs on many threads at once
+extern const std::string PARSE_JUMPTABLE_THUNK_USECS;
+extern const std::string PARSE_JUMPTABLE_FORMAT_USECS;
+extern const std::string PARSE_JUMPTABLE_INDEX_USECS;
+extern const std::string PARSE_JUMPTABLE_READ_USECS;
 
 #endif
@@ -79,6 +79,7 @@ class MTLock;
 namespace Dyninst {
 
 class SymbolReaderFactory;
+class MachSyscall;
 
 namespace ProcControlAPI {
 
@@ -475,6 +476,60 @@ class PC_EXPORT Process : public boost::enable_shared_from_this<Process>
    bool writeMemoryAsync(Dyninst::Address addr, const void *buffer, size_t size, void *opaque_val = NULL) const;
    bool readMemoryAsync(void *buffer, Dyninst::Address addr, size_t size, void *opaque_val = NULL) const;
 
+   /**
+    * Vectored memory access.  Every element is attempted and its err field
+    * is set to err_none on success.  Returns true only if all elements
+    * succeeded.  Where the platform allows it (process_vm_readv/writev on
+    * Linux) the whole batch is moved with a single system call.
+    **/
+   struct read_t {
+      Dyninst::Address addr;
+      void *buffer;
+      size_t size;
+      err_t err;
+   };
+   struct write_t {
+      Dyninst::Address addr;
+      const void *buffer;
+      size_t size;
+      err_t err;
+   };
+   bool readMemory(std::vector<read_t> &reads) const;
+   bool writeMemory(std::vector<write_t> &writes) const;
+
+   /**
+    * Opt-in cache of whole target pages for synchronous memory reads.
+    * Pages are only cached while every thread is stopped, writes made
+    * through this API update them, and the cache is emptied whenever any
+    * thread continues.  Hits and misses are counted in pages.
+    **/
+   bool setReadCache(bool enable);
+   bool getReadCacheStats(unsigned long &hits, unsigned long &misses) const;
+
+   /**
+    * Counts software breakpoints inserted into or removed from this
+    * process, and the memory transfers made to do so.  Bulk operations
+    * through ProcessSet read and write each affected page once, so
+    * transfers can be far fewer than breakpoints.
+    **/
+   bool getBreakpointIOStats(unsigned long &bps, unsigned long &transfers) const;
+
+   /**
+    * Restrict syscall events to the given syscalls by installing a
+    * seccomp filter in the target.  Threads in syscall mode then only stop
+    * at those syscalls instead of at every syscall entry and exit.  The
+    * process must be stopped.  Currently Linux/x86_64 only.
+    *
+    * Filters cannot be removed, and forked children inherit them.  Calling
+    * this again can only narrow the set.  Without a tracer the filtered
+    * syscalls fail with ENOSYS, so once a filter is installed detach and
+    * temporaryDetach fail, and fork tracking must stay FollowFork::Follow.
+    * Installing the filter also sets PR_SET_NO_NEW_PRIVS in the target,
+    * which stays set for it and its children: a later execve will not
+    * gain privileges from setuid/setgid bits or file capabilities.
+    **/
+   bool setSyscallFilter(const std::vector<MachSyscall> &syscalls);
+
    /** 
     * Currently Windows-only, needed for the test infrastructure but possibly useful elsewhere 
     **/
@@ -521,6 +576,14 @@ class PC_EXPORT Process : public boost::enable_shared_from_this<Process>
     **/
 	bool runIRPCAsync(IRPC::ptr irpc);
 
+   /**
+    * IRPCs created without an address run out of a scratch arena that is
+    * mapped into the process once and reused, rather than each getting
+    * its own allocation and deallocation.  On by default; turning it off
+    * leaves an existing arena mapped but stops handing out space in it.
+    **/
+   bool setIRPCArena(bool enable);
+
    /**
     * Symbol access
     **/
@@ -108,10 +108,17 @@ class PC_EXPORT LWPTracking
    ~LWPTracking();
    Process::weak_ptr proc;
    static bool default_track_lwps;
+   static bool default_seize_attach;
   public:
    static void setDefaultTrackLWPs(bool b);
    static bool getDefaultTrackLWPs();
 
+   //Linux only: attach with PTRACE_SEIZE and stop individual LWPs with
+   // PTRACE_INTERRUPT instead of PTRACE_ATTACH and SIGSTOP.  Only affects
+   // processes attached after the call (and their forked children).
+   static void setDefaultSeizeAttach(bool b);
+   static bool getDefaultSeizeAttach();
+
    void setTrackLWPs(bool b) const;
    bool getTrackLWPs() const;
    bool refreshLWPs();
@@ -65,6 +65,7 @@ class int_thread;
 class int_threadPool;
 class handlerpool;
 class int_iRPC;
+class iRPCArena;
 
 typedef std::multimap<Dyninst::Address, Dyninst::ProcControlAPI::Process::ptr> int_addressSet;
 typedef std::set<Dyninst::ProcControlAPI::Process::ptr> int_processSet;
@@ -303,6 +304,7 @@ class int_process
    bool execed();
    virtual bool plat_detach(result_response::ptr resp, bool leave_stopped) = 0;
    virtual bool plat_detachDone();
+   virtual void plat_exited();
   protected:
    virtual bool plat_execed();
    virtual bool plat_terminate(bool &needs_sync) = 0;
@@ -314,9 +316,9 @@ class int_process
    bool waitfor_startup();
 
    void setPid(Dyninst::PID pid);
-   int_thread *findStoppedThread();
 
   public:
+   int_thread *findStoppedThread();
    virtual bool plat_processGroupContinues();
 
    typedef enum {
@@ -382,6 +384,14 @@ class int_process
    virtual bool plat_individualRegRead(Dyninst::MachRegister reg, int_thread *thr);
    virtual bool plat_individualRegSet();
 
+   //Fills the register caches of every stopped thread that doesn't have
+   // one yet, so a burst of register reads after a stop costs one pass
+   // over the threads.  The caches are dropped when a thread continues.
+   bool fetchStoppedRegisters();
+   virtual void plat_getAllRegistersBatch(std::vector<int_thread *> &thrs,
+                                          std::vector<int_registerPool> &pools,
+                                          std::vector<bool> &ok);
+
    int getAddressWidth();
    HandlerPool *handlerPool() const;
 
@@ -435,6 +445,28 @@ class int_process
    virtual bool plat_writeMem(int_thread *thr, const void *local,
                               Dyninst::Address remote, size_t size, bp_write_t bp_write) = 0;
 
+   //Vectored, synchronous memory access.  Each element is transferred
+   // independently and its 'done' flag records whether it succeeded.  The
+   // default plat_ implementations loop over plat_readMem/plat_writeMem;
+   // platforms that can move a whole batch in one operation override them.
+   struct mem_iov_t {
+      void *local;
+      Dyninst::Address remote;
+      size_t size;
+      bool done;
+   };
+   bool readMemv(std::vector<mem_iov_t> &iov, int_thread *thr = NULL);
+   bool writeMemv(std::vector<mem_iov_t> &iov, int_thread *thr = NULL);
+   virtual bool plat_readMemv(int_thread *thr, std::vector<mem_iov_t> &iov);
+   virtual bool plat_writeMemv(int_thread *thr, std::vector<mem_iov_t> &iov);
+
+   //Installs a kernel filter so that only the given syscall numbers stop
+   // threads that are in syscall mode.
+   virtual bool plat_installSyscallFilter(const std::vector<unsigned long> &nums);
+   //True if such a filter is in place.  It can't be removed, and without a
+   // tracer the filtered syscalls fail, so the process can't be detached.
+   virtual bool plat_hasSyscallFilter();
+
    virtual async_ret_t plat_calcTLSAddress(int_thread *thread, int_library *lib, Offset off,
                                            Address &outaddr, std::set<response::ptr> &resps);
 
@@ -470,6 +502,9 @@ class int_process
                                                Process::MemoryRegion& memRegion);
 
    memCache *getMemCache();
+   pageCache *getPageCache();
+   bpPageBatch *getBPBatch();
+   iRPCArena *getRPCArena();
 
    virtual bool plat_getOSRunningStates(std::map<Dyninst::LWP, bool> &runningStates) = 0;
 	// Windows-only technically
@@ -576,6 +611,9 @@ class int_process
    int continueSig;
    bool createdViaAttach;
    memCache mem_cache;
+   pageCache page_cache;
+   bpPageBatch bp_batch;
+   iRPCArena *rpc_arena;
    Counter async_event_count;
    Counter force_generator_block_count;
    Counter startupteardown_procs;
@@ -1003,6 +1041,7 @@ public:
    void updateRegCache(int_registerPool &pool);
    void updateRegCache(Dyninst::MachRegister reg, Dyninst::MachRegisterVal val);
    void clearRegCache();
+   bool hasFullRegCache();
 
    // The exiting property is separate from the main state because an
    // exiting thread can either be running or stopped (depending on the
@@ -34,6 +34,7 @@
 #include <map>
 #include <list>
 #include <set>
+#include <vector>
 
 #include "common/h/dyntypes.h"
 #include "Handler.h"
@@ -69,6 +70,7 @@ class iRPCAllocation
 	  // HACK: affirmatively set that we do need a data save. If we've just allocated space, why save the data?
       needs_datasave(false),
       have_saved_regs(false),
+      is_arena(false),
       ref_count(0)
       {
       }
@@ -84,6 +86,7 @@ class iRPCAllocation
    void *orig_data;
    bool needs_datasave;
    bool have_saved_regs;
+   bool is_arena;
    int ref_count;
 
    //These are NULL if the user handed us memory to run the iRPC in.
@@ -225,6 +228,50 @@ class int_iRPC : public boost::enable_shared_from_this<int_iRPC>
    void *user_data;
 };
 
+//Per-process scratch memory that iRPCs are carved out of, so an iRPC
+// doesn't need its own allocation and deallocation iRPCs.  The arena is
+// mapped by an allocation iRPC that runs ahead of the first iRPC that
+// wants it, and stays mapped for the life of the address space.  Slots
+// are handed out per iRPC and returned when the iRPC completes, so iRPCs
+// on different threads can be in flight at once.
+class iRPCArena
+{
+  public:
+   static const unsigned long slot_size = 128;
+   static const unsigned long default_size = 16 * 1024;
+
+   iRPCArena(int_process *p);
+   ~iRPCArena();
+
+   void setEnabled(bool b);
+   bool isEnabled() const;
+   bool isReady() const;
+
+   //Returns an allocation for rpc on thr, or an empty pointer if the rpc
+   // should be allocated the old way.  If the arena itself needs mapping,
+   // alloc_rpc is set to an allocation iRPC that must be queued first.
+   iRPCAllocation::ptr reserve(int_thread *thr, int_iRPC::ptr rpc, int_iRPC::ptr &alloc_rpc);
+   void release(int_iRPC::ptr rpc);
+
+   //Called when the allocation iRPC for the arena has run
+   bool isArenaAllocation(iRPCAllocation::ptr a) const;
+   void setBase(Dyninst::Address addr);
+
+   void reset();
+   void copyFrom(iRPCArena *parent);
+  private:
+   int_process *proc;
+   bool enabled;
+   Dyninst::Address base;
+   unsigned long size;
+   std::vector<bool> used;
+   std::map<unsigned long, std::pair<unsigned, unsigned> > owners;
+   iRPCAllocation::ptr pending_alloc;
+   boost::weak_ptr<int_iRPC> pending_rpc;
+   int_thread *pending_thread;
+   std::vector<std::pair<iRPCAllocation::ptr, unsigned long> > waiting;
+};
+
 //Singleton class, only one of these across all processes.
 class iRPCMgr
 {
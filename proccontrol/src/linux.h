@@ -67,6 +67,7 @@ class GeneratorLinux : public GeneratorMT
    virtual bool initialize();
    virtual bool canFastHandle();
    virtual ArchEvent *getEvent(bool block);
+   virtual bool getMultiEvent(bool block, std::vector<ArchEvent *> &events);
    void evictFromWaitpid();
 };
 
@@ -116,6 +117,7 @@ class linux_process : public sysv_process, public unix_process, public thread_db
    virtual bool plat_forked();
    virtual bool plat_execed();
    virtual bool plat_detach(result_response::ptr resp, bool leave_stopped);
+   virtual void plat_exited();
    virtual bool plat_terminate(bool &needs_sync);
    virtual bool preTerminate();
    virtual OSType getOS() const;
@@ -133,6 +135,8 @@ class linux_process : public sysv_process, public unix_process, public thread_db
                              Dyninst::Address remote, size_t size);
    virtual bool plat_writeMem(int_thread *thr, const void *local,
                               Dyninst::Address remote, size_t size, bp_write_t bp_write);
+   virtual bool plat_readMemv(int_thread *thr, std::vector<mem_iov_t> &iov);
+   virtual bool plat_writeMemv(int_thread *thr, std::vector<mem_iov_t> &iov);
    virtual SymbolReaderFactory *plat_defaultSymReader();
    virtual bool needIndividualThreadAttach();
    virtual bool getThreadLWPs(std::vector<Dyninst::LWP> &lwps);
@@ -156,8 +160,32 @@ class linux_process : public sysv_process, public unix_process, public thread_db
    virtual bool plat_getResidentUsage(unsigned long stacku, unsigned long heapu, unsigned long sharedu,
                                       MemUsageResp_t *resp);
 
+   virtual bool plat_installSyscallFilter(const std::vector<unsigned long> &nums);
+   virtual bool plat_hasSyscallFilter();
+   virtual void plat_getAllRegistersBatch(std::vector<int_thread *> &thrs,
+                                          std::vector<int_registerPool> &pools,
+                                          std::vector<bool> &ok);
+
   protected:
    int computeAddrWidth();
+   bool readSeccompStatus(unsigned long &mode, unsigned long &filters);
+
+   //The /proc/<pid>/mem descriptor is opened on first use and kept until
+   // the address space goes away (exec, detach or exit).
+   int getMemFD();
+   void closeMemFD();
+   void transferVM(bool is_write, std::vector<mem_iov_t> &iov);
+
+   int mem_fd;
+   bool use_vm_rw;
+   //True if attached with PTRACE_SEIZE; threads are then stopped with
+   // PTRACE_INTERRUPT rather than SIGSTOP.
+   bool seized;
+  public:
+   bool isSeized() const { return seized; }
+   //True once a seccomp filter is installed; syscall stops then come from
+   // PTRACE_EVENT_SECCOMP instead of PTRACE_SYSCALL.
+   bool syscall_filtered;
 };
 
 class linux_x86_process : public linux_process, public x86_process
@@ -235,9 +263,14 @@ class linux_thread : virtual public thread_db_thread
    virtual bool suppressSanityChecks();
 
    void setGeneratorExiting() { generator_started_exit_processing = true; }
+   void setSeccompExitPending(bool b) { seccomp_exit_pending = b; }
+   void setGroupStopped() { group_stopped = true; }
  private:
    ArchEventLinux *postponed_syscall_event;
    bool generator_started_exit_processing;
+   bool seccomp_exit_pending;
+   //Seized thread reported a group-stop; it is resumed with PTRACE_LISTEN
+   bool group_stopped;
 };
 
 class linux_x86_thread : virtual public linux_thread, virtual public x86_thread
@@ -269,7 +302,8 @@ private:
       create_req,
       ptrace_req,
       ptrace_bulkread,
-      ptrace_bulkwrite
+      ptrace_bulkwrite,
+      ptrace_multireq
    } req_t;
 
    req_t ptrace_request;
@@ -283,6 +317,17 @@ private:
    long ret;
    bool bret;
    int err;
+  public:
+   typedef struct {
+      pt_req request;
+      pid_t pid;
+      void *addr;
+      void *data;
+      long ret;
+      int err;
+   } ptrace_op_t;
+  private:
+   std::vector<ptrace_op_t> *ops;
 
    DThread thrd;
    CondVar<> init;
@@ -303,6 +348,8 @@ public:
    long ptrace_int(pt_req request_, pid_t pid_, void *addr_, void *data_);
    bool ptrace_read(Dyninst::Address inTrace, unsigned size_, void *inSelf, int pid_);
    bool ptrace_write(Dyninst::Address inTrace, unsigned size_, const void *inSelf, int pid_);
+   //Runs a batch of requests in one trip to the ptrace thread
+   void ptrace_multi(std::vector<ptrace_op_t> &ops_);
 
    bool plat_create(linux_process *p);
 };
@@ -35,6 +35,7 @@
 #include "response.h"
 #include <set>
 #include <map>
+#include <vector>
 
 class int_process;
 
@@ -165,4 +166,109 @@ class memCache {
                                int_thread *writing_thrd = NULL);
 };
 
+/**
+ * pageCache is an opt-in, synchronous read cache of whole target pages.
+ * Unlike memCache it is meant for arbitrary reads: it is only consulted
+ * while every thread in the process is stopped, writes through
+ * int_process::writeMem update it, and any thread continue (or exec,
+ * detach) starts a new stop epoch, which empties it.  This lets several
+ * stackwalkers and readers working in the same stop share page reads.
+ **/
+class pageCache {
+  private:
+   int_process *proc;
+   bool enabled;
+   unsigned page_size;
+   unsigned long epoch;
+   unsigned long cached_epoch;
+   unsigned long hits;
+   unsigned long misses;
+   typedef std::map<Dyninst::Address, char *> pages_t;
+   pages_t pages;
+
+   static const unsigned max_pages = 4096;
+
+   char *getPage(int_thread *thr, Dyninst::Address page_addr);
+   void syncEpoch();
+  public:
+   pageCache(int_process *p);
+   ~pageCache();
+
+   void setEnabled(bool b);
+   bool isEnabled() const;
+   bool isUsable();
+
+   //Returns false if the range could not be served through the cache; the
+   // caller should then fall back to an uncached read.
+   bool read(int_thread *thr, void *dest, Dyninst::Address src, unsigned long size);
+   void updateWithWrite(Dyninst::Address dest, const void *src, unsigned long size);
+
+   void invalidate();
+   void clear();
+
+   unsigned long getHits() const;
+   unsigned long getMisses() const;
+};
+
+/**
+ * Coalesces the memory traffic of bulk breakpoint insertion and removal
+ * on synchronous platforms.  While a batch is open the pages under the
+ * breakpoints are fetched in one vectored read, original bytes are saved
+ * from and traps are patched into the local copies, and each page's dirty
+ * span is written back in one vectored write when the batch is closed.
+ * Ranges on pages that could not be fetched fall back to direct access.
+ **/
+class bpPageBatch {
+  private:
+   struct page_t {
+      page_t() : loaded(false), dirty(false), lo(0), hi(0) {}
+      std::vector<char> data;
+      bool loaded;
+      bool dirty;
+      unsigned long lo;
+      unsigned long hi;
+   };
+   struct pending_t {
+      Dyninst::Address addr;
+      unsigned long size;
+      result_response::ptr resp;
+   };
+   typedef std::map<Dyninst::Address, page_t> pages_t;
+
+   int_process *proc;
+   bool active;
+   unsigned page_size;
+   pages_t pages;
+   std::vector<pending_t> pending;
+   unsigned long breakpoints;
+   unsigned long transfers;
+
+   page_t *getLoadedPage(Dyninst::Address page_addr);
+   bool covers(Dyninst::Address addr, unsigned long size);
+  public:
+   bpPageBatch(int_process *p);
+   ~bpPageBatch();
+
+   //Opens a batch; returns false if the platform cannot batch.
+   bool begin();
+   bool isActive() const;
+   void addRange(Dyninst::Address addr, unsigned long size);
+   bool load();
+
+   //Return false if the range is not held by the batch; the caller
+   // should then access memory directly.
+   bool read(Dyninst::Address addr, void *dest, unsigned long size);
+   bool write(Dyninst::Address addr, const void *src, unsigned long size,
+              result_response::ptr resp);
+
+   //Writes back dirty pages, completes the pending write responses and
+   // closes the batch.
+   bool end();
+
+   void noteBreakpoint();
+   void noteTransfer();
+   unsigned long getBreakpoints() const;
+   unsigned long getTransfers() const;
+};
+
 #endif
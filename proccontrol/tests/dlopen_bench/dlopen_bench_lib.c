@@ -0,0 +1,11 @@
+/* One of the small libraries loaded by dlopen_bench_mutatee.
+ * CMakeLists.txt builds a copy for each LIB_ID. */
+#define DLB_NAME2(a, b) a ## b
+#define DLB_NAME(a, b) DLB_NAME2(a, b)
+
+int DLB_NAME(dlb_data_, LIB_ID) = LIB_ID;
+
+int DLB_NAME(dlb_func_, LIB_ID)(void)
+{
+   return DLB_NAME(dlb_data_, LIB_ID);
+}
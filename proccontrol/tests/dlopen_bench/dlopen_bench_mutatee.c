@@ -0,0 +1,50 @@
+/* Target for dlopen_bench.  Usage: dlopen_bench_mutatee MODE DIR COUNT
+ *   open     dlopen DIR/libdlb_0.so .. libdlb_COUNT-1.so in order, then exit
+ *   cycle    open COUNT libraries, dlclose every other one, reopen those,
+ *            then exit
+ * Every dlopen and dlclose of a new library is a trip through the dynamic
+ * linker's breakpoint for a mutator that tracks libraries. */
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void *open_lib(const char *dir, int i)
+{
+   char path[4096];
+   void *handle;
+   snprintf(path, sizeof(path), "%s/libdlb_%d.so", dir, i);
+   handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+   if (!handle) {
+      fprintf(stderr, "dlopen_bench_mutatee: %s\n", dlerror());
+      exit(-1);
+   }
+   return handle;
+}
+
+int main(int argc, char *argv[])
+{
+   const char *mode, *dir;
+   void **handles;
+   int count, i;
+
+   if (argc < 4) {
+      fprintf(stderr, "Usage: %s open|cycle dir count\n", argv[0]);
+      return -1;
+   }
+   mode = argv[1];
+   dir = argv[2];
+   count = atoi(argv[3]);
+   handles = (void **) calloc(count ? count : 1, sizeof(void *));
+
+   for (i = 0; i < count; i++)
+      handles[i] = open_lib(dir, i);
+
+   if (strcmp(mode, "cycle") == 0) {
+      for (i = 0; i < count; i += 2)
+         dlclose(handles[i]);
+      for (i = 0; i < count; i += 2)
+         handles[i] = open_lib(dir, i);
+   }
+   return 0;
+}
@@ -0,0 +1,19 @@
+/* Target for event_stress_bench: fork argv[1] short-lived children, reap
+ * them, and exit. */
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+int main(int argc, char *argv[])
+{
+   int i, children = argc > 1 ? atoi(argv[1]) : 32;
+   for (i = 0; i < children; i++) {
+      pid_t pid = fork();
+      if (pid == 0)
+         _exit(0);
+   }
+   while (wait(NULL) > 0)
+      ;
+   return 0;
+}
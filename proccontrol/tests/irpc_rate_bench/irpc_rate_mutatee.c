@@ -0,0 +1,10 @@
+/* Idle target for irpc_rate_bench; the injected code is self-contained,
+ * so all we do is stay alive. */
+#include <unistd.h>
+
+int main()
+{
+   for (;;)
+      sleep(1);
+   return 0;
+}
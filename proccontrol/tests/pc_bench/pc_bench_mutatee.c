@@ -0,0 +1,71 @@
+/* Target for pc_bench.  The first argument picks the workload:
+ *   idle          sleep forever (attach/detach)
+ *   spin FD       report addresses on FD, then call bench_bp_target forever
+ *   threads N     create and join N threads, then exit
+ *   fork N        fork N children that exit at once, reap them, then exit
+ * The spin report is one line "pid target buffer" so that many copies can
+ * share one pipe. */
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#define BENCH_BUFFER_SIZE (1024 * 1024)
+
+char bench_buffer[BENCH_BUFFER_SIZE];
+volatile unsigned long bench_calls;
+
+__attribute__((noinline)) void bench_bp_target(void)
+{
+   bench_calls++;
+}
+
+static void *thread_main(void *arg)
+{
+   return arg;
+}
+
+int main(int argc, char *argv[])
+{
+   const char *mode = argc > 1 ? argv[1] : "idle";
+   int count = argc > 2 ? atoi(argv[2]) : 0;
+   int i;
+
+   if (strcmp(mode, "spin") == 0) {
+      char line[128];
+      int len;
+      memset(bench_buffer, 0xa5, sizeof(bench_buffer));
+      len = snprintf(line, sizeof(line), "%d %lx %lx\n", (int) getpid(),
+                     (unsigned long) bench_bp_target, (unsigned long) bench_buffer);
+      if (write(count, line, len) != len)
+         return -1;
+      close(count);
+      for (;;)
+         bench_bp_target();
+   }
+   else if (strcmp(mode, "threads") == 0) {
+      pthread_t *thrs = (pthread_t *) malloc(sizeof(pthread_t) * (count ? count : 1));
+      for (i = 0; i < count; i++)
+         pthread_create(&thrs[i], NULL, thread_main, NULL);
+      for (i = 0; i < count; i++)
+         pthread_join(thrs[i], NULL);
+      free(thrs);
+   }
+   else if (strcmp(mode, "fork") == 0) {
+      for (i = 0; i < count; i++) {
+         pid_t pid = fork();
+         if (pid == 0)
+            _exit(0);
+         if (pid > 0)
+            waitpid(pid, NULL, 0);
+      }
+   }
+   else {
+      for (;;)
+         sleep(1);
+   }
+   return 0;
+}
@@ -0,0 +1,10 @@
+/* Idle target for procset_mem_bench; the benchmark only touches memory it
+ * allocates in this process, so all we do is stay alive. */
+#include <unistd.h>
+
+int main()
+{
+   for (;;)
+      sleep(1);
+   return 0;
+}
@@ -0,0 +1,35 @@
+/* seize_attach mutatee: reports the address of a counter on the fd named
+ * by argv[1], then bumps it from the main thread and two helper threads.
+ */
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+volatile unsigned long seize_counter;
+
+static void *spin(void *arg)
+{
+   (void) arg;
+   for (;;)
+      __sync_fetch_and_add(&seize_counter, 1);
+   return NULL;
+}
+
+int main(int argc, char *argv[])
+{
+   int fd = argc > 1 ? atoi(argv[1]) : 1;
+   char line[64];
+   int len, i;
+   pthread_t thrs[2];
+
+   for (i = 0; i < 2; i++)
+      pthread_create(&thrs[i], NULL, spin, NULL);
+   len = snprintf(line, sizeof(line), "%lx\n", (unsigned long) &seize_counter);
+   if (write(fd, line, len) != len)
+      return -1;
+   close(fd);
+   spin(NULL);
+   return 0;
+}
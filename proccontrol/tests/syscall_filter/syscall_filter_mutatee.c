@@ -0,0 +1,49 @@
+/* syscall_filter mutatee: calls getppid, which the driver filters, a known
+ * number of times, then forks a child that calls it too.  The child exits
+ * nonzero if any call fails, and so does the parent if the child did.
+ */
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#define PARENT_CALLS 10
+#define CHILD_CALLS 5
+
+static int call_getppid(int n)
+{
+   int i;
+   for (i = 0; i < n; i++) {
+      if (syscall(SYS_getppid) == -1) {
+         fprintf(stderr, "getppid failed in %d: %d\n", (int) getpid(), errno);
+         return -1;
+      }
+      /* Not filtered, should never stop */
+      syscall(SYS_getpid);
+   }
+   return 0;
+}
+
+int main(void)
+{
+   pid_t child;
+   int status;
+
+   if (call_getppid(PARENT_CALLS) == -1)
+      return 1;
+
+   child = fork();
+   if (child == -1)
+      return 2;
+   if (child == 0)
+      _exit(call_getppid(CHILD_CALLS) == -1 ? 3 : 0);
+
+   if (waitpid(child, &status, 0) != child)
+      return 4;
+   if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+      return 5;
+   return 0;
+}
@@ -0,0 +1,150 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef COMPACTTREE_H_
+#define COMPACTTREE_H_
+
+#include "basetypes.h"
+#include <string>
+#include <vector>
+
+namespace Dyninst {
+namespace Stackwalker {
+
+class Walker;
+class Frame;
+class CallTree;
+
+/**
+ * A call tree for aggregating very large numbers of stacks.  Nodes live
+ * in a single array and are identified by index, frames are keyed by
+ * object and offset (or by function) so trees from different processes
+ * and walkers can be merged, and object and function names are interned.
+ * Children of all nodes share one hash index rather than per-node sets.
+ *
+ * Trees can be serialized into a flat buffer and merged from one without
+ * building an intermediate tree, e.g. when a front end combines the trees
+ * of many daemons.
+ **/
+class SW_EXPORT CompactCallTree {
+  public:
+   typedef unsigned node_id;
+   typedef unsigned string_id;
+
+   static const node_id root = 0;
+   static const node_id no_node = (node_id) -1;
+   static const string_id no_string = (string_id) -1;
+
+   typedef enum {
+      key_offset,    //One node per object offset
+      key_function   //One node per function, needs symbol lookup
+   } key_t;
+
+   struct node_t {
+      node_id parent;
+      node_id first_child;
+      node_id next_sibling;
+      string_id object;        //no_string if the PC was not in a known object
+      string_id function;      //no_string until named
+      Dyninst::Offset offset;  //Object offset, or the raw PC without an object
+      unsigned long count;     //Stacks through this node
+      unsigned long ends;      //Stacks ending at this node
+   };
+
+   CompactCallTree(key_t k = key_offset);
+   ~CompactCallTree();
+
+   key_t getKey() const;
+
+   //Add a stack, top frame first as returned by Walker::walkStack.
+   // Returns the node of the top frame.
+   node_id addCallStack(const std::vector<Frame> &stk);
+
+   //Add raw PCs, top frame first, e.g. from Walker::walkStackSignalSafe.
+   // 'walker' provides the library state used to turn PCs into offsets.
+   node_id addCallStack(const Dyninst::Address *pcs, unsigned num, Walker *walker);
+
+   //Add every thread's stack from a CallTree
+   void addCallTree(const CallTree &tree);
+
+   //Add a single frame below 'parent' without counting a stack
+   node_id addFrame(node_id parent, string_id object, Dyninst::Offset offset,
+                    string_id function = no_string);
+
+   //Merge another tree with the same key into this one
+   bool merge(const CompactCallTree &other);
+
+   //Serialize into 'buffer', replacing its contents.  The format is in
+   // host byte order.
+   void serialize(std::vector<char> &buffer) const;
+   //Merge a serialized tree into this one
+   bool mergeSerialized(const void *buffer, size_t size);
+
+   string_id intern(const std::string &s);
+   const std::string &getString(string_id id) const;
+   size_t numStrings() const;
+
+   const node_t &getNode(node_id id) const;
+   size_t numNodes() const;
+   //Name a node of a key_offset tree.  Nodes of key_function trees are
+   // named when created and are not renamed.
+   void setFunction(node_id id, string_id function);
+
+   //Approximate heap use, in bytes
+   size_t memoryUsage() const;
+
+  private:
+   struct child_key_t {
+      node_id parent;
+      string_id object;
+      Dyninst::Offset value;
+      bool operator==(const child_key_t &o) const {
+         return parent == o.parent && object == o.object && value == o.value;
+      }
+   };
+   struct child_hash_t {
+      size_t operator()(const child_key_t &k) const;
+   };
+
+   node_id frameNode(node_id parent, const Frame &f);
+   node_id pcNode(node_id parent, Dyninst::Address pc, Walker *walker);
+   void countStack(node_id top, unsigned long count, unsigned long ends);
+
+   key_t key;
+   std::vector<node_t> nodes;
+   std::vector<const std::string *> strings;
+   dyn_hash_map<std::string, string_id> string_index;
+   dyn_hash_map<child_key_t, node_id, child_hash_t> child_index;
+};
+
+}
+}
+
+#endif
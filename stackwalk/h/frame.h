@@ -47,6 +47,7 @@ class FrameStepper;
 class SW_EXPORT Frame : public AnnotatableDense {
   friend class Walker;
   friend class CallTree;
+  friend class SymbolCache;
   friend class ::StackCallback;
 protected:
   Dyninst::MachRegisterVal ra;
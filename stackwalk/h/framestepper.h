@@ -138,6 +138,14 @@ public:
   virtual void registerStepperGroup(StepperGroup *group);
   virtual ~DebugStepper();
   virtual const char *getName() const;
+
+  //Step through per-object unwind tables precompiled from the CFI,
+  // rather than interpreting the CFI at every frame.  On by default.
+  static void setUnwindTables(bool enable);
+  //If set, unwind tables are saved to and reloaded from this directory.
+  static void setUnwindTableDir(std::string dir);
+  //Hits and misses in the step cache shared by every DebugStepper
+  static void getCacheStats(unsigned long &hits, unsigned long &misses);
 };
 
 class CallChecker;
@@ -225,6 +233,18 @@ class SW_EXPORT AnalysisStepper : public FrameStepper {
    virtual void registerStepperGroup(StepperGroup *group);
    virtual ~AnalysisStepper();
    virtual const char *getName() const;
+
+   //Step through per-object tables of precomputed stack heights, built
+   // in the background for objects the stepper analyzes often.  On by
+   // default.
+   static void setHeightTables(bool enable);
+   //If set, height tables are saved to and reloaded from this directory.
+   static void setHeightTableDir(std::string dir);
+   //Queue a table build for an object ahead of time, e.g. before sampling.
+   static void precomputeHeightTable(std::string object);
+   //Wait for queued table builds to finish.
+   static void waitForHeightTables();
+   static void getHeightTableStats(unsigned long &hits, unsigned long &misses);
 };
 
 class SW_EXPORT DyninstDynamicHelper
@@ -62,6 +62,10 @@ protected:
    std::string executable_path;
 
    ProcessState(Dyninst::PID pid_ = 0, std::string executable_path_ = std::string(""));
+   //For states that are not live processes, such as core files.  These
+   // are not registered by pid, so they never clash with a live process
+   // or with each other.
+   ProcessState(Dyninst::PID pid_, std::string executable_path_, bool register_pid);
    void setPid(Dyninst::PID pid_);
 public:
 
@@ -164,6 +168,52 @@ class SW_EXPORT ProcDebug : public ProcessState {
   virtual Dyninst::Architecture getArchitecture();
 };
 
+class CoreImage;
+
+/**
+ * A process that has died, read from its ELF core file.  The core is
+ * mapped rather than read, and memory and registers are served straight
+ * out of the mapping: PT_LOAD segments for memory (falling back to the
+ * mapped files listed in the NT_FILE note for text that was not dumped),
+ * and NT_PRSTATUS notes for each thread's registers.  Loaded libraries
+ * come from the link map in the core.  Only cores from the same
+ * architecture as the walker are supported.
+ **/
+class SW_EXPORT ProcCore : public ProcessState {
+ protected:
+   boost::shared_ptr<CoreImage> core;
+   std::vector<Dyninst::THR_ID> threads;
+   ProcCore(boost::shared_ptr<CoreImage> core_, const std::vector<Dyninst::THR_ID> &threads_);
+ public:
+  //Map core_file.  executable is the program that dumped it; if it is
+  // empty, the program is found in the core's NT_FILE note.
+  static ProcCore *newProcCore(std::string core_file,
+                               std::string executable = std::string(""));
+
+  //A new ProcCore on the same mapped core that only shows 'thrds'.  A
+  // Walker is used by one thread at a time, so walking a core's threads
+  // in parallel takes one view and Walker per worker.
+  ProcCore *newView(const std::vector<Dyninst::THR_ID> &thrds);
+  virtual ~ProcCore();
+
+  virtual bool getRegValue(Dyninst::MachRegister reg, Dyninst::THR_ID thread, Dyninst::MachRegisterVal &val);
+  virtual bool readMem(void *dest, Dyninst::Address source, size_t size);
+  virtual bool getThreadIds(std::vector<Dyninst::THR_ID> &thrds);
+  virtual bool getDefaultThread(Dyninst::THR_ID &default_tid);
+  virtual unsigned getAddressWidth();
+  virtual bool isFirstParty();
+  virtual Dyninst::Architecture getArchitecture();
+
+  //Point at 'size' bytes of the dead process's memory at 'addr' without
+  // copying them, or return NULL if they are not contiguous in the core.
+  // The pointer is valid for as long as this ProcCore.
+  const void *getMemPtr(Dyninst::Address addr, size_t size);
+
+  //The signal that caused the dump, or 0 if the core does not say
+  int getSignal();
+  std::string getCorePath();
+};
+
 //LibAddrPair.first = path to library, LibAddrPair.second = load address
 typedef std::pair<std::string, Address> LibAddrPair;
 typedef enum { library_load, library_unload } lib_change_t;
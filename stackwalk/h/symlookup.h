@@ -32,6 +32,7 @@
 #define SYMLOOKUP_H_
 
 #include <string>
+#include <vector>
 #include "basetypes.h"
 
 namespace Dyninst {
@@ -39,9 +40,12 @@ namespace Stackwalker {
 
 class Walker;
 class ProcessState;
+class Frame;
+class int_symbolCache;
 
 class SW_EXPORT SymbolLookup {
   friend class Walker;
+  friend class int_symbolCache;
  protected:
   Walker *walker;
  public:
@@ -56,6 +60,9 @@ class SW_EXPORT SymbolLookup {
   virtual ProcessState *getProcessState();
  private:
   std::string executable_path;
+  //Keys this lookup's SymbolCache entries.  Never reused, so a lookup
+  // allocated where a deleted one was doesn't get its results.
+  unsigned long cache_id;
 };
 
 class SW_EXPORT SwkSymtab : public SymbolLookup {
@@ -76,6 +83,54 @@ class SymDefaultLookup : public SymbolLookup {
     virtual ~SymDefaultLookup();
 };
 
+//One resolved address.  Names and files are interned by the SymbolCache
+// and shared by every entry that resolves to them.
+typedef struct {
+   const std::string *name;  //Demangled function name, empty if not found
+   const std::string *file;  //Source file, empty without line info
+   unsigned line;
+   void *value;              //As from SymbolLookup::lookupAtAddr
+   bool found;
+} sym_info_t;
+
+/**
+ * Resolves addresses in batches.  Each batch is deduplicated by object
+ * and offset, lookups are grouped by object and done in address order so
+ * neighbouring addresses reuse the previous symbol and line ranges, and
+ * results are kept in a cache shared by every walker using it.  Entries
+ * are never removed, so returned pointers stay valid for the life of the
+ * cache.  All methods may be called from several threads at once.
+ **/
+class SW_EXPORT SymbolCache {
+  private:
+   int_symbolCache *icache;
+  public:
+   SymbolCache(bool with_lines = false);
+   ~SymbolCache();
+
+   //A cache shared by the whole process, without line information
+   static SymbolCache *getDefault();
+
+   //Resolve frames, and set their names and values so Frame::getName
+   // and Frame::getObject do not look them up again.  Like Frame::getName,
+   // every frame is looked up at its RA minus one.  results, if given, is
+   // filled in frame order.
+   bool symbolize(std::vector<Frame> &frames,
+                  std::vector<const sym_info_t *> *results = NULL);
+
+   //Resolve raw PCs from walker's process, top frame first, as from
+   // Walker::walkStackSignalSafe
+   bool symbolize(Walker *walker, const Dyninst::Address *pcs, unsigned num,
+                  std::vector<const sym_info_t *> &results);
+
+   //Resolve offsets within one object file
+   bool symbolize(const std::string &object, const std::vector<Dyninst::Offset> &offsets,
+                  std::vector<const sym_info_t *> &results);
+
+   size_t size() const;
+   void getStats(unsigned long &hits, unsigned long &misses) const;
+};
+
 }
 }
 
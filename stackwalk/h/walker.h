@@ -115,6 +115,17 @@ class SW_EXPORT Walker {
    static Walker *newWalker(std::string exec_name, 
                             const std::vector<std::string> &argv);
 
+   //Create an object that operates on a core file (see ProcCore)
+   static Walker *newCoreWalker(std::string core_file,
+                                std::string executable = std::string(""));
+   //Create up to max_walkers walkers on one core file, sharing its
+   // threads between them, so that a WalkerSet can walk the threads in
+   // parallel.  With max_walkers of 0, there is one walker per thread.
+   static bool newCoreWalkers(std::string core_file,
+                              std::string executable,
+                              std::vector<Walker *> &walkers_out,
+                              unsigned max_walkers = 0);
+
    //Create an object with custom backend classes
    static Walker *newWalker(ProcessState *proc, 
                             StepperGroup *grp = NULL,
@@ -139,6 +150,23 @@ class SW_EXPORT Walker {
    bool walkSingleFrame(const Frame &in, 
                         Frame &out);
 
+   //Snapshot the loaded objects and their unwind tables for
+   // walkStackSignalSafe.  First party only; call again after libraries
+   // are loaded or unloaded, or threads are created, since walks only
+   // read stacks that were mapped when this was called.
+   bool prepareSignalSafeWalks();
+
+   //Walk the stack described by 'context' (the ucontext_t * given to an
+   // SA_SIGINFO handler, or NULL for the caller's own stack) without
+   // allocating or taking locks, so it may be called from a signal
+   // handler.  Writes at most 'max' PCs into ras, and the matching SPs
+   // and FPs into sps and fps when they are not NULL.  Returns the
+   // number of frames written.  Frame::newFrame can turn the results
+   // into symbolized frames later, outside the handler.
+   unsigned walkStackSignalSafe(void *context, Dyninst::Address *ras,
+                                Dyninst::Address *sps, Dyninst::Address *fps,
+                                unsigned max);
+
    //Return the intitial frame in a stackwalk.
    bool getInitialFrame(Frame &frame, 
                         Dyninst::THR_ID thread = NULL_THR_ID);
@@ -165,9 +193,20 @@ class SW_EXPORT Walker {
    bool creation_error;
    StepperGroup *group;
    unsigned call_count;
+   void *sigsafe_state; //Opaque, owned by sigsafe-walk.C
+   void freeSignalSafeState();
    static SymbolReaderFactory *symrfact;
 };
 
+//Timing for one thread's stackwalk during WalkerSet::walkStacks
+typedef struct {
+   Walker *walker;
+   Dyninst::THR_ID thread;
+   double usec;
+   unsigned frames;
+   bool ok;
+} walk_latency_t;
+
 class SW_EXPORT WalkerSet {
   private:
    int_walkerSet *iwalkerset;
@@ -193,6 +232,20 @@ class SW_EXPORT WalkerSet {
    size_t size() const;
 
    bool walkStacks(CallTree &tree, bool walk_initial_only = false) const;
+
+   //Number of threads walkStacks spreads its walkers over.  1 (the
+   // default) walks every process in the calling thread, 0 picks one
+   // worker per CPU.  Each process is walked by a single worker, so this
+   // only helps sets of several processes; the threads of one process
+   // are walked one after another.  Steppers that parse or analyze
+   // binaries serialize that work on a shared lock.  Sets with
+   // ProcControlAPI-backed walkers are walked in the calling thread unless
+   // ProcControlAPI runs in HandlerThreading or CallbackThreading mode.
+   void setNumWorkers(unsigned n);
+   unsigned getNumWorkers() const;
+
+   //Per-thread latencies from the last walkStacks call, grouped by walker
+   const std::vector<walk_latency_t> &getWalkLatencies() const;
 };
 
 }
@@ -35,8 +35,11 @@
 #include "dataflowAPI/h/stackanalysis.h"
 #include "dataflowAPI/h/Absloc.h"
 #include "SymReader.h"
+#include "concurrent.h"
 
 #include <string>
+#include <atomic>
+#include <boost/shared_ptr.hpp>
 
 namespace Dyninst {
 namespace ParseAPI {
@@ -50,12 +53,55 @@ class CodeSource;
 namespace Dyninst {
 namespace Stackwalker {
 
+//Stack heights for the instructions of the functions in one object, as
+// sorted offset ranges with equal heights merged.  Ranges where
+// overlapping functions disagree are marked ambiguous.
+class HeightTable
+{
+  public:
+   typedef boost::shared_ptr<HeightTable> Ptr;
+
+   struct row_t {
+      Offset lo;
+      uint32_t len;
+      int32_t sp;
+      int32_t fp;
+      uint8_t sp_type;
+      uint8_t fp_type;
+      uint8_t ambiguous;
+      uint8_t pad;
+   };
+
+   //Returns the row covering off, or NULL.
+   const row_t *find(Offset off) const;
+   size_t size() const;
+
+   //Rows may be added in any order; finish() sorts them, resolves
+   // overlaps and merges adjacent rows with equal heights.
+   void addRow(Offset lo, unsigned len, const StackAnalysis::Height &sp,
+               const StackAnalysis::Height &fp);
+   void finish();
+
+   static StackAnalysis::Height getHeight(int32_t height, uint8_t type);
+
+   //Persist the table.  'ident' should identify the object version;
+   // load fails if it does not match.
+   bool save(std::string path, unsigned long ident) const;
+   static Ptr load(std::string path, unsigned long ident);
+
+  private:
+   std::vector<row_t> rows;
+};
+
 class CallChecker;
 class AnalysisStepperImpl : public FrameStepper
 {
   private:
    AnalysisStepper *parent;
    CallChecker * callchecker;
+   //The last table used, so that steps within one object skip the lock
+   std::string last_table_name;
+   HeightTable::Ptr last_table;
   public:
    AnalysisStepperImpl(Walker *w, AnalysisStepper *p);
    virtual ~AnalysisStepperImpl();
@@ -69,15 +115,44 @@ class AnalysisStepperImpl : public FrameStepper
    virtual unsigned getPriority() const;  
    
    virtual const char *getName() const;
+
+   static void setHeightTables(bool enable);
+   static void setHeightTableDir(std::string dir);
+   static void precomputeHeightTable(std::string name);
+   static void waitForHeightTables();
+   static void getHeightTableStats(unsigned long &hits, unsigned long &misses);
    
   protected:
    
+   //Parsed objects are shared by every walker; objs_lock guards the maps,
+   // parse_lock parsing of and lookups in the objects themselves
    static std::map<std::string, ParseAPI::CodeObject *> objs;
    static std::map<std::string, ParseAPI::CodeSource*> srcs;
    static std::map<std::string, SymReader*> readers;
+   static dyn_mutex objs_lock;
+   static dyn_mutex parse_lock;
    
    static ParseAPI::CodeObject *getCodeObject(std::string name);
    static ParseAPI::CodeSource *getCodeSource(std::string name);
+   static ParseAPI::CodeSource *newCodeSource(std::string name);
+   static SymReader *getReader(std::string name);
+
+   //Height tables for hot objects are built by background workers and
+   // shared by every walker
+   static bool use_height_tables;
+   static std::string height_table_dir;
+   static std::atomic<unsigned long> height_hits;
+   static std::atomic<unsigned long> height_misses;
+   static HeightTable::Ptr getHeightTable(const std::string &name);
+   static HeightTable::Ptr buildHeightTable(const std::string &name);
+   static void queueHeightTable(const std::string &name);
+#if defined(os_windows)
+   static unsigned long WINAPI heightWorker(void *);
+#else
+   static void heightWorker(void *);
+#endif
+   static void stopHeightWorkers();
+   bool lookupHeightTable(const std::string &name, Offset off, std::set<height_pair_t> &heights);
 
    std::set<height_pair_t> analyzeFunction(std::string name, Offset off);
    std::vector<registerState_t> fullAnalyzeFunction(std::string name, Offset off);
@@ -33,12 +33,16 @@
 
 #include "stackwalk/h/framestepper.h"
 #include "common/h/ProcReader.h"
+#include "common/h/concurrent.h"
+#include <atomic>
 
 namespace Dyninst {
 
 namespace DwarfDyninst {
 class DwarfFrameParser;
 typedef boost::shared_ptr<DwarfFrameParser> DwarfFrameParserPtr;
+class UnwindTable;
+typedef boost::shared_ptr<UnwindTable> UnwindTablePtr;
 };
 
 namespace Stackwalker {
@@ -50,20 +54,40 @@ class DebugStepperImpl : public FrameStepper, public Dyninst::ProcessReader {
       unsigned fp_delta;
       unsigned sp_delta;
       // Note: ra and fp are differences in address, sp is difference in value. 
+      // All are relative to the register the CFA is computed from
+      // (UnwindTable::base_sp or base_fp).
+      int cfa_base;
 
-    cache_t() : ra_delta((unsigned) -1), fp_delta((unsigned) -1), sp_delta((unsigned) -1) {};
-    cache_t(unsigned a, unsigned b, unsigned c) : ra_delta(a), fp_delta(b), sp_delta(c) {};
+    cache_t() : ra_delta((unsigned) -1), fp_delta((unsigned) -1), sp_delta((unsigned) -1), cfa_base(0) {};
+    cache_t(unsigned a, unsigned b, unsigned c, int d) : ra_delta(a), fp_delta(b), sp_delta(c), cfa_base(d) {};
     };
 
-    dyn_hash_map<Address, cache_t> cache_;
+    //Step results for one object, keyed by offset.  These are shared by
+    // every DebugStepper, so an object's steps are computed once for all
+    // walkers and all processes that load it, wherever it is loaded.
+    // Deltas are kept relative to the CFA's base register, so FP-based
+    // frames (e.g. with alloca) step correctly in every process; steps
+    // whose CFA needs a full DWARF expression aren't cached.
+    typedef dyn_c_hash_map<Address, cache_t> step_cache_t;
+    static step_cache_t *getStepCache(const std::string &obj);
+    step_cache_t *cur_cache; //Cache and load address of the object being stepped
+    Address cur_base;
+    static std::atomic<unsigned long> cache_hits;
+    static std::atomic<unsigned long> cache_misses;
 
-    void addToCache(const Frame &cur, const Frame &caller);
+    void addToCache(const Frame &cur, const Frame &caller, int cfa_base);
     bool lookupInCache(const Frame &cur, Frame &caller);
 
    Dyninst::Address last_addr_read;
    unsigned long last_val_read;
    unsigned addr_width;
       
+   static bool use_unwind_tables;
+   static std::string unwind_table_dir;
+   bool stepWithUnwindTable(Address pc, const Frame &in, Frame &out,
+                            const std::string &lib,
+                            DwarfDyninst::DwarfFrameParserPtr dinfo);
+
    location_t getLastComputedLocation(unsigned long val);
    DebugStepper *parent_stepper;
    const Frame *cur_frame; //TODO: Thread safety
@@ -79,6 +103,11 @@ class DebugStepperImpl : public FrameStepper, public Dyninst::ProcessReader {
   virtual bool start() { return true; }
   virtual bool done() { return true; }
   virtual const char *getName() const;
+
+  static void setUnwindTables(bool enable);
+  static void setUnwindTableDir(std::string dir);
+  static void getCacheStats(unsigned long &hits, unsigned long &misses);
+  static DwarfDyninst::UnwindTablePtr getLibUnwindTable(const std::string &lib);
  protected:
   gcframe_ret_t getCallerFrameArch(Address pc, const Frame &in, Frame &out, 
                                    DwarfDyninst::DwarfFrameParserPtr dinfo, bool isVsyscallPage);
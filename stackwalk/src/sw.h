@@ -155,6 +155,12 @@ class DyninstInstFrameStepperImpl : public FrameStepper {
 };
 
 
+//Path of the file a per-object table with the given suffix is saved to in
+// dir, and an ident that changes whenever the object does.  Returns false
+// without a directory or if the object can't be found.
+bool savedTablePath(const std::string &dir, const std::string &obj, const char *suffix,
+                    std::string &path, unsigned long &ident);
+
 class CallChecker {
   private:
    ProcessState * proc;
@@ -178,8 +184,11 @@ private:
    void clearProcSet();
    void initProcSet();
    bool walkStacksProcSet(CallTree &tree, bool &bad_plat, bool walk_iniital_only);
+   void stopProcSet(std::set<Walker *> &stopped);
 
    unsigned non_pd_walkers;
+   unsigned num_workers;
+   std::vector<walk_latency_t> latencies;
    set<Walker *> walkers;
    void *procset; //Opaque pointer, will refer to a ProcControl::ProcessSet in some situations
 };
@@ -0,0 +1,36 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define NUM_SPINNERS 2
+#define CRASH_DEPTH 5
+
+static volatile int started;
+
+void *core_walk_spin(void *arg)
+{
+   __sync_fetch_and_add(&started, 1);
+   for (;;)
+      sleep(1);
+   return arg;
+}
+
+__attribute__((noinline)) void core_walk_crash(int depth)
+{
+   if (depth == 0)
+      abort();
+   core_walk_crash(depth - 1);
+   __asm__ __volatile__("");
+}
+
+int main()
+{
+   pthread_t t;
+   int i;
+   for (i = 0; i < NUM_SPINNERS; i++)
+      pthread_create(&t, NULL, core_walk_spin, NULL);
+   while (started < NUM_SPINNERS)
+      usleep(1000);
+   core_walk_crash(CRASH_DEPTH);
+   return 0;
+}
@@ -0,0 +1,94 @@
+/* Call chain for sw_bench, shared by the benchmark (first party) and
+ * its mutatee (third party).  This file is compiled twice: once with
+ * frame pointers as CHAIN=fp and once without them as CHAIN=nofp.  Each
+ * copy has four distinct functions, each calling the next one in the
+ * other copy, so a walk alternates between frames with and without
+ * frame pointers.  Odd steps make their call from an
+ * always-inlined helper, so those return addresses fall inside inlined
+ * code.  Once, at sw_bench_signal_depth, the chain raises SIGUSR1 and
+ * continues from the handler, which puts a signal frame on the stack.
+ * At the bottom it calls sw_bench_leaf, which the program provides. */
+#include <signal.h>
+#include <string.h>
+
+#define CAT2(a, b) a##b
+#define CAT(a, b) CAT2(a, b)
+#define STEP(chain, n) CAT(chain, _step##n)
+
+unsigned sw_bench_leaf(void);
+
+unsigned STEP(CHAIN, 0)(unsigned d);
+unsigned STEP(OTHER_CHAIN, 0)(unsigned d);
+unsigned STEP(OTHER_CHAIN, 1)(unsigned d);
+unsigned STEP(OTHER_CHAIN, 2)(unsigned d);
+unsigned STEP(OTHER_CHAIN, 3)(unsigned d);
+
+#if defined(CHAIN_ENTRY)
+unsigned sw_bench_signal_depth;
+static volatile unsigned signal_next;
+static volatile unsigned signal_result;
+static volatile int signal_raised;
+
+static void chain_handler(int sig)
+{
+   (void) sig;
+   signal_result = STEP(OTHER_CHAIN, 0)(signal_next);
+}
+
+int sw_bench_raise(unsigned d)
+{
+   if (signal_raised || d != sw_bench_signal_depth)
+      return 0;
+   signal_raised = 1;
+   signal_next = d - 1;
+   raise(SIGUSR1);
+   return 1;
+}
+
+unsigned sw_bench_signal_result(void)
+{
+   return signal_result;
+}
+
+unsigned sw_bench_run(unsigned depth, unsigned signal_depth)
+{
+   struct sigaction act;
+   memset(&act, 0, sizeof(act));
+   act.sa_handler = chain_handler;
+   sigemptyset(&act.sa_mask);
+   sigaction(SIGUSR1, &act, NULL);
+
+   sw_bench_signal_depth = signal_depth;
+   signal_raised = 0;
+   return STEP(CHAIN, 0)(depth);
+}
+#else
+int sw_bench_raise(unsigned d);
+unsigned sw_bench_signal_result(void);
+#endif
+
+static inline __attribute__((always_inline)) unsigned inline_call(unsigned (*next)(unsigned),
+                                                                  unsigned d)
+{
+   volatile unsigned char scratch[24];
+   scratch[d % sizeof(scratch)] = (unsigned char) d;
+   return next(d - 1) + scratch[d % sizeof(scratch)];
+}
+
+#define STEP_FN(n, next, inlined)                                  \
+   __attribute__((noinline)) unsigned STEP(CHAIN, n)(unsigned d)   \
+   {                                                               \
+      volatile char pad[16 * (n + 1)];                             \
+      pad[0] = (char) d;                                           \
+      if (d == 0)                                                  \
+         return sw_bench_leaf() + pad[0];                          \
+      if (sw_bench_raise(d))                                       \
+         return sw_bench_signal_result() + pad[0];                 \
+      if (inlined)                                                 \
+         return inline_call(STEP(OTHER_CHAIN, next), d) + pad[0];  \
+      return STEP(OTHER_CHAIN, next)(d - 1) + pad[0];              \
+   }
+STEP_FN(0, 1, 0)
+STEP_FN(1, 2, 1)
+STEP_FN(2, 3, 0)
+STEP_FN(3, 0, 1)
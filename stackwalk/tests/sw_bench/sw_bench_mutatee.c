@@ -0,0 +1,34 @@
+/* Target for sw_bench's third-party walks.  Usage:
+ *   sw_bench_mutatee DEPTH SIGNAL_DEPTH FD
+ * Builds the call chain from sw_bench_chain.c to DEPTH frames, writes its
+ * pid to FD once it is at the bottom, and spins there until killed. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+unsigned sw_bench_run(unsigned depth, unsigned signal_depth);
+
+static int ready_fd = -1;
+volatile unsigned long sw_bench_spins;
+
+unsigned sw_bench_leaf(void)
+{
+   char line[32];
+   int len = snprintf(line, sizeof(line), "%d\n", (int) getpid());
+   if (write(ready_fd, line, len) != len)
+      exit(-1);
+   close(ready_fd);
+   for (;;)
+      sw_bench_spins++;
+   return 0;
+}
+
+int main(int argc, char *argv[])
+{
+   if (argc < 4) {
+      fprintf(stderr, "Usage: %s depth signal_depth fd\n", argv[0]);
+      return -1;
+   }
+   ready_fd = atoi(argv[3]);
+   return (int) sw_bench_run(atoi(argv[1]), atoi(argv[2]));
+}
@@ -0,0 +1,43 @@
+/* Target for walkset_workers.  Usage:
+ *   walkset_workers_mutatee FD
+ * Recurses CHAIN_DEPTH frames, writes its pid to FD once it is at the
+ * bottom, and spins there until killed. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define CHAIN_DEPTH 8
+
+static int ready_fd = -1;
+volatile unsigned long walkset_spins;
+
+void walkset_leaf(void)
+{
+   char line[32];
+   int len = snprintf(line, sizeof(line), "%d\n", (int) getpid());
+   if (write(ready_fd, line, len) != len)
+      exit(-1);
+   close(ready_fd);
+   for (;;)
+      walkset_spins++;
+}
+
+void walkset_chain(int depth)
+{
+   if (depth)
+      walkset_chain(depth - 1);
+   else
+      walkset_leaf();
+   walkset_spins++;
+}
+
+int main(int argc, char *argv[])
+{
+   if (argc < 2) {
+      fprintf(stderr, "Usage: %s fd\n", argv[0]);
+      return -1;
+   }
+   ready_fd = atoi(argv[1]);
+   walkset_chain(CHAIN_DEPTH);
+   return 0;
+}